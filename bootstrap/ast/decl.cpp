@@ -269,6 +269,7 @@ func_decl* func_decl::clone() const {
     }
     ret->is_public = is_public;
     ret->is_extern = is_extern;
+    ret->is_lazy = is_lazy;
     return ret;
 }
 
@@ -377,6 +378,7 @@ impl* impl::clone() const {
     for (auto i : conds) {
         ret->add_cond(i->clone());
     }
+    ret->is_instance = is_instance;
     return ret;
 }
 
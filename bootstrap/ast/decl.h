@@ -327,13 +327,15 @@ private:
     // flags
     bool is_public;
     bool is_extern;
+    // method of generic instance not referenced yet, skipped by sema and mir
+    bool is_lazy;
 
 public:
     func_decl(const span& loc):
         decl(ast_type::ast_func_decl, loc),
         name(""), generic_types(nullptr), parameters(nullptr),
         return_type(nullptr), block(nullptr),
-        is_public(false), is_extern(false) {}
+        is_public(false), is_extern(false), is_lazy(false) {}
     ~func_decl() override;
     void accept(visitor*) override;
     func_decl* clone() const override;
@@ -363,6 +365,8 @@ public:
     bool is_public_func() const { return is_public; }
     void set_extern(bool b) { is_extern = b; }
     bool is_extern_func() const { return is_extern; }
+    void set_lazy(bool b) { is_lazy = b; }
+    bool is_lazy_method() const { return is_lazy; }
 
 public:
     void add_cond(cond_compile* node) { conds.push_back(node); }
@@ -383,10 +387,13 @@ private:
     // conditional compile attribute
     std::vector<cond_compile*> conds;
 
+    // generated from generic impl by generic visitor
+    bool is_instance;
+
 public:
     impl(const span& loc, const std::string& n):
         decl(ast_type::ast_impl, loc), name(n),
-        generic_types(nullptr) {}
+        generic_types(nullptr), is_instance(false) {}
     ~impl() override;
     void accept(visitor*) override;
     impl* clone() const override;
@@ -406,6 +413,8 @@ public:
             generic_types = nullptr;
         }
     }
+    void set_instance(bool b) { is_instance = b; }
+    bool is_generic_instance() const { return is_instance; }
 
 public:
     void add_cond(cond_compile* node) { conds.push_back(node); }
@@ -46,8 +46,21 @@ bool delete_disabled_node::check_enable_if(error& err, cond_compile* cc) {
 }
 
 bool delete_disabled_node::check_conds(error& err,
-                                       const std::vector<cond_compile*>& conds) {
+                                       const std::vector<cond_compile*>& conds,
+                                       ast_type kind) {
     for (auto i : conds) {
+        // #[inline] and #[noinline] are only hints for the optimizer
+        if (kind == ast_type::ast_func_decl &&
+            (i->get_condition_name() == "inline" ||
+             i->get_condition_name() == "noinline")) {
+            continue;
+        }
+        // #[layout(optimal)] allows reordering fields, bootstrap compiler
+        // always keeps the declaration order, which is also a valid layout
+        if (kind == ast_type::ast_struct_decl &&
+            i->get_condition_name() == "layout") {
+            continue;
+        }
         if (i->get_condition_name() != "enable_if") {
             err.err(
                 i->get_location(),
@@ -63,7 +76,8 @@ bool delete_disabled_node::check_conds(error& err,
 void delete_disabled_node::report_not_supported_condition(error& err,
                                                           impl* node) {
     static const std::unordered_set<std::string> valid_conditions = {
-        "is_trivial", "is_non_trivial", "is_pointer", "is_non_pointer"
+        "is_trivial", "is_non_trivial", "is_pointer", "is_non_pointer",
+        "inline", "noinline"
     };
     for (auto i : node->get_methods()) {
         for (auto j : i->get_conds()) {
@@ -83,28 +97,28 @@ void delete_disabled_node::scan(error& err, root* node) {
     for (auto i : node->get_decls()) {
         switch (i->get_ast_type()) {
             case ast_type::ast_enum_decl:
-                if (check_conds(err, static_cast<enum_decl*>(i)->get_conds())) {
+                if (check_conds(err, static_cast<enum_decl*>(i)->get_conds(), i->get_ast_type())) {
                     new_root_decls.push_back(i);
                 } else {
                     delete i;
                 }
                 break;
             case ast_type::ast_struct_decl:
-                if (check_conds(err, static_cast<struct_decl*>(i)->get_conds())) {
+                if (check_conds(err, static_cast<struct_decl*>(i)->get_conds(), i->get_ast_type())) {
                     new_root_decls.push_back(i);
                 } else {
                     delete i;
                 }
                 break;
             case ast_type::ast_func_decl:
-                if (check_conds(err, static_cast<func_decl*>(i)->get_conds())) {
+                if (check_conds(err, static_cast<func_decl*>(i)->get_conds(), i->get_ast_type())) {
                     new_root_decls.push_back(i);
                 } else {
                     delete i;
                 }
                 break;
             case ast_type::ast_impl:
-                if (check_conds(err, static_cast<impl*>(i)->get_conds())) {
+                if (check_conds(err, static_cast<impl*>(i)->get_conds(), i->get_ast_type())) {
                     new_root_decls.push_back(i);
                     report_not_supported_condition(err, static_cast<impl*>(i));
                 } else {
@@ -18,7 +18,7 @@ private:
 
 private:
     bool check_enable_if(error&, cond_compile*);
-    bool check_conds(error&, const std::vector<cond_compile*>&);
+    bool check_conds(error&, const std::vector<cond_compile*>&, ast_type);
     void report_not_supported_condition(error&, impl*);
 
 public:
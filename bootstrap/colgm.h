@@ -10,6 +10,10 @@
 #include <cstring>
 #include <sstream>
 #include <cmath>
+#include <functional>
+#include <unordered_map>
+#include <mutex>
+#include <atomic>
 
 #ifndef _MSC_VER
 #include <unistd.h>
@@ -78,6 +82,40 @@ std::string char_to_hex(const char);
 
 std::string mangle(const std::string&);
 
+// mangled names and llvm type names are used by every type and call, so
+// they are memoized for the whole compilation and shared by ast2mir,
+// mir2sir and the sir dumpers. worker threads look them up at the same
+// time, each table has its own lock and counters
+class mangling_cache {
+public:
+    struct table {
+        std::mutex mutex;
+        std::unordered_map<std::string, std::string> names;
+        std::atomic<u64> hit{0};
+        std::atomic<u64> miss{0};
+
+        // get cached name of the key, or make and cache it
+        std::string get(const std::string&, const std::function<std::string()>&);
+    };
+
+public:
+    // mangled type name, keyed by file and generic name of the type
+    table type_names;
+    // llvm type name mapped by mir2sir, keyed by file and type string
+    table llvm_type_names;
+    // mangled function name, keyed by full path name
+    table function_names;
+
+public:
+    static mangling_cache& singleton() {
+        static mangling_cache cache;
+        return cache;
+    }
+    std::string function_name(const std::string& name) {
+        return function_names.get(name, [&]() { return mangle(name); });
+    }
+};
+
 bool llvm_visible_char(char c);
 std::string llvm_raw_string(const std::string&);
 
@@ -85,4 +123,15 @@ std::string local_time_str();
 
 usize levenshtein_distance(const std::string&, const std::string&);
 
+// worker threads used by parallel phases, hardware concurrency by default
+usize worker_count();
+void set_worker_count(usize);
+// threads used by parallel_for to run count tasks
+usize parallel_thread_count(usize count);
+// run task(thread, index) for index in [0, count) on worker threads,
+// thread is in [0, parallel_thread_count(count)) and can be used to reuse
+// per thread state. tasks may finish in any order, so results should be
+// stored by index and merged in order
+void parallel_for(usize count, const std::function<void(usize, usize)>& task);
+
 }
\ No newline at end of file
@@ -21,6 +21,7 @@ const u32 COMPILE_VIEW_SEMA = 1<<3;
 const u32 COMPILE_VIEW_SIR = 1<<4;
 const u32 COMPILE_VIEW_MIR = 1<<5;
 const u32 COMPILE_VIEW_PASS = 1<<6;
+const u32 COMPILE_EAGER_GENERIC = 1<<7;
 
 std::ostream& help(std::ostream& out) {
     out
@@ -37,8 +38,10 @@ std::ostream& help(std::ostream& out) {
     << "         --mir            | view mir.\n"
     << "         --sir            | view sir.\n"
     << "   -L,   --library <path> | add library path.\n"
+    << "   -j,   --jobs <number>  | worker threads, default cpu count.\n"
     << "         --dump-lib       | view libraries.\n"
     << "         --pass-info      | view pass info.\n"
+    << "         --eager-generic  | check and generate all generic instance methods.\n"
     << "         --arch           | specify target arch.\n"
     << "         --platform       | specify target platform.\n"
     << "file:\n"
@@ -94,6 +97,21 @@ void scan_package(const std::string& library_path,
     }
 }
 
+void report_mangling_cache() {
+    auto& cache = colgm::mangling_cache::singleton();
+    const std::pair<const char*, const colgm::mangling_cache::table*> tables[] = {
+        {"type name", &cache.type_names},
+        {"llvm type name", &cache.llvm_type_names},
+        {"function name", &cache.function_names}
+    };
+    for (const auto& i : tables) {
+        std::clog << "  " << colgm::green << "SIR" << colgm::reset;
+        std::clog << " mangling cache " << colgm::cyan << "<" << i.first << ">";
+        std::clog << colgm::reset << ": " << i.second->hit << " hit, ";
+        std::clog << i.second->miss << " miss\n";
+    }
+}
+
 void execute(const std::string& input_file,
              const std::string& output_file,
              const u32 cmd = 0) {
@@ -103,6 +121,7 @@ void execute(const std::string& input_file,
     colgm::parse parser(err);
     colgm::semantic sema(err);
     sema.set_main_input_file(input_file);
+    sema.set_eager_generic(cmd & COMPILE_EAGER_GENERIC);
     colgm::mir::ast2mir ast2mir(err, sema.get_context());
 
     // ast -> mir -> sir generator pass
@@ -134,6 +153,7 @@ void execute(const std::string& input_file,
 
     // generate mir code
     ast2mir.generate(parser.get_result()).chkerr();
+    ast2mir.generate_lazy_methods(sema.get_lazy_foreign()).chkerr();
     mpm.execute(colgm::mir::ast2mir::get_context(), cmd & COMPILE_VIEW_PASS);
     if (cmd & COMPILE_VIEW_MIR) {
         colgm::mir::ast2mir::dump(std::cout);
@@ -150,6 +170,9 @@ void execute(const std::string& input_file,
 
     std::ofstream out(output_file);
     mir2sir.get_mutable_sir_context().dump_code(out);
+    if (cmd & COMPILE_VIEW_PASS) {
+        report_mangling_cache();
+    }
 }
 
 i32 main(i32 argc, const char* argv[]) {
@@ -187,6 +210,7 @@ i32 main(i32 argc, const char* argv[]) {
         {"--sir", COMPILE_VIEW_SIR},
         {"--dump-lib", COMPILE_VIEW_LIB},
         {"--pass-info", COMPILE_VIEW_PASS},
+        {"--eager-generic", COMPILE_EAGER_GENERIC},
     };
     u32 cmd = 0;
     std::string input_file = "";
@@ -218,6 +242,17 @@ i32 main(i32 argc, const char* argv[]) {
             } else {
                 err();
             }
+        } else if (args[i] == "-j" || args[i] == "--jobs") {
+            if (i + 1 < argc) {
+                const auto count = colgm::str_to_num(args[i + 1].c_str());
+                if (std::isnan(count) || count < 1) {
+                    err();
+                }
+                colgm::set_worker_count(static_cast<usize>(count));
+                ++i;
+            } else {
+                err();
+            }
         } else if (args[i] == "--arch") {
             if (i + 1 < argc) {
                 colgm::target_info::singleton()->set_arch(args[i + 1]);
@@ -2,16 +2,17 @@
 
 namespace colgm::mir {
 
-void adjust_va_arg_func::adjust_posix_open() {
-    if (!used_funcs.count("open")) {
+void adjust_va_arg_func::adjust(const std::string& name,
+                                usize real_param_size) {
+    if (!used_funcs.count(name)) {
         return;
     }
 
-    auto open_func = used_funcs.at("open");
-    while (open_func->params.size() > 2) {
-        open_func->params.pop_back();
+    auto func = used_funcs.at(name);
+    while (func->params.size() > real_param_size) {
+        func->params.pop_back();
     }
-    open_func->with_va_args = true;
+    func->with_va_args = true;
 }
 
 bool adjust_va_arg_func::run(mir_context* c) {
@@ -22,7 +23,9 @@ bool adjust_va_arg_func::run(mir_context* c) {
         used_funcs.insert({i->name, i});
     }
 
-    adjust_posix_open();
+    for (const auto& i : variadic_libc_funcs) {
+        adjust(i.first, i.second);
+    }
     return true;
 }
 
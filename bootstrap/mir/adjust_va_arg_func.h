@@ -8,12 +8,21 @@
 
 namespace colgm::mir {
 
+// libc functions declared with fixed parameters in colgm but variadic in C,
+// mapped to the number of parameters before `...`.
+// On macOS aarch64 variadic arguments are passed on stack, so these must
+// be declared and called as variadic functions on all the platforms
+inline const std::unordered_map<std::string, usize> variadic_libc_funcs = {
+    {"open", 2},  // open(const char*, int, ...)
+    {"fcntl", 2}  // fcntl(int, int, ...)
+};
+
 class adjust_va_arg_func: public pass {
 private:
     std::unordered_map<std::string, mir_func*> used_funcs;
 
 private:
-    void adjust_posix_open();
+    void adjust(const std::string&, usize);
 
 public:
     ~adjust_va_arg_func() override = default;
@@ -1,7 +1,9 @@
 #include "mir/ast2mir.h"
 #include "ast/dumper.h"
 
+#include <algorithm>
 #include <cassert>
+#include <memory>
 
 namespace colgm::mir {
 
@@ -176,6 +178,14 @@ bool ast2mir::visit_union_decl(ast::union_decl* node) {
         new_union->member_type.push_back(generate_type(i->get_type()));
     }
 
+    const auto& dm = ctx.get_domain(node->get_location().file);
+    if (dm.unions.count(node->get_name())) {
+        for (const auto& i : dm.unions.at(node->get_name()).member_int_map) {
+            new_union->tag_min = std::min(new_union->tag_min, i.second);
+            new_union->tag_max = std::max(new_union->tag_max, i.second);
+        }
+    }
+
     mctx.unions.push_back(new_union);
     return true;
 }
@@ -190,7 +200,7 @@ bool ast2mir::visit_func_decl(ast::func_decl* node) {
             .name = impl_struct_name,
             .loc_file = node->get_file()
         };
-        name = mangle(tmp.full_path_name()) + "." + name;
+        name = tmp.mangled_name() + "." + name;
     }
     // global function which is not extern
     if (impl_struct_name.empty() && !node->is_extern_func()) {
@@ -198,7 +208,7 @@ bool ast2mir::visit_func_decl(ast::func_decl* node) {
             .name = name,
             .loc_file = node->get_file()
         };
-        name = mangle(tmp.full_path_name());
+        name = mangling_cache::singleton().function_name(tmp.full_path_name());
     }
 
     auto func = new mir_func();
@@ -214,7 +224,7 @@ bool ast2mir::visit_func_decl(ast::func_decl* node) {
 
     // insert if is declaration
     if (!node->get_code_block()) {
-        mctx.decls.push_back(func);
+        output->decls.push_back(func);
         return true;
     }
 
@@ -228,7 +238,7 @@ bool ast2mir::visit_func_decl(ast::func_decl* node) {
         }
     }
     block = nullptr;
-    mctx.impls.push_back(func);
+    output->impls.push_back(func);
     return true;
 }
 
@@ -238,6 +248,10 @@ bool ast2mir::visit_impl(ast::impl* node) {
     }
     impl_struct_name = node->get_name();
     for (auto i : node->get_methods()) {
+        // never referenced, so not resolved by sema
+        if (i->is_lazy_method()) {
+            continue;
+        }
         i->accept(this);
     }
     impl_struct_name = "";
@@ -729,6 +743,74 @@ type ast2mir::generate_type(ast::type_base* node) {
     return tr.resolve(reinterpret_cast<ast::type_def*>(node));
 }
 
+const error& ast2mir::generate(ast::root* ast_root) {
+    for (auto i : ast_root->get_use_stmts()) {
+        i->accept(this);
+    }
+
+    // functions and impls are generated by workers, structs and unions
+    // are cheap and generated here
+    std::vector<ast::decl*> decls;
+    for (auto i : ast_root->get_decls()) {
+        if (i->is(ast::ast_type::ast_func_decl) ||
+            i->is(ast::ast_type::ast_impl)) {
+            decls.push_back(i);
+        } else {
+            i->accept(this);
+        }
+    }
+
+    return generate_by_workers(
+        decls.size(),
+        [&](usize) { return ctx.this_file; },
+        [&](ast2mir& worker, usize index) { decls[index]->accept(&worker); }
+    );
+}
+
+const error& ast2mir::generate_lazy_methods(const std::vector<usize>& indices) {
+    const auto& lazy_methods = ctx.global.lazy_methods;
+    return generate_by_workers(
+        indices.size(),
+        [&](usize index) { return lazy_methods[indices[index]].owner_file; },
+        [&](ast2mir& worker, usize index) {
+            const auto& m = lazy_methods[indices[index]];
+            worker.impl_struct_name = m.impl->get_name();
+            m.method->accept(&worker);
+            worker.impl_struct_name = "";
+        }
+    );
+}
+
+// each task is generated by a worker with its own reporter and output,
+// in the context of the module whose ast holds the task
+const error& ast2mir::generate_by_workers(
+    usize count,
+    const std::function<std::string(usize)>& owner_file,
+    const std::function<void(ast2mir&, usize)>& task) {
+    std::vector<std::unique_ptr<error>> errors(count);
+    std::vector<mir_context> results(count);
+    parallel_for(count, [&](usize, usize index) {
+        errors[index] = std::make_unique<error>(true);
+        sema_context owner_ctx;
+        owner_ctx.this_file = owner_file(index);
+        ast2mir worker(*errors[index], owner_ctx);
+        worker.output = &results[index];
+        task(worker, index);
+    });
+
+    // merge in task order, so function order is the same as
+    // generating them one by one
+    for (usize i = 0; i < count; ++i) {
+        err.merge(*errors[i]);
+        auto& res = results[i];
+        mctx.decls.insert(mctx.decls.end(), res.decls.begin(), res.decls.end());
+        mctx.impls.insert(mctx.impls.end(), res.impls.begin(), res.impls.end());
+        res.decls.clear();
+        res.impls.clear();
+    }
+    return err;
+}
+
 void ast2mir::dump(std::ostream& os) {
     for (const auto i : mctx.structs) {
         os << i->name << " {";
@@ -29,6 +29,12 @@ struct mir_union {
     span location;
     std::vector<type> member_type;
 
+    // range of tag values, zero is included because a union may be
+    // zero initialized. tag uses the smallest integer holding them
+    i64 tag_min = 0;
+    i64 tag_max = 0;
+    u64 tag_size = 8;
+
     bool size_calculated = false;
     u64 total_size = 0;
     u64 union_size = 0;
@@ -81,6 +87,9 @@ private:
 
 private:
     static inline mir_context mctx;
+    // functions are generated into this context,
+    // workers use their own one and the results are merged in order
+    mir_context* output = &mctx;
     std::string impl_struct_name = "";
     mir_block* block = nullptr;
 
@@ -125,16 +134,20 @@ private:
 
 private:
     type generate_type(ast::type_base*);
+    const error& generate_by_workers(
+        usize,
+        const std::function<std::string(usize)>&,
+        const std::function<void(ast2mir&, usize)>&);
 
 public:
     ast2mir(error& e, const sema_context& c): err(e), ctx(c), tr(e, c) {}
 
 public:
     static void dump(std::ostream&);
-    auto& generate(ast::root* ast_root) {
-        ast_root->accept(this);
-        return err;
-    }
+    const error& generate(ast::root*);
+    // generate methods of generic instances owned by modules generated
+    // before, but referenced for the first time by this module
+    const error& generate_lazy_methods(const std::vector<usize>&);
     static auto get_context() { return &mctx; }
 };
 
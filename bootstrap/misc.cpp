@@ -5,6 +5,8 @@
 #include <iomanip>
 #include <vector>
 #include <algorithm>
+#include <atomic>
+#include <thread>
 
 #ifndef _MSC_VER
 #include <unistd.h>
@@ -332,6 +334,27 @@ std::string mangle(const std::string& name) {
     return copy;
 }
 
+std::string mangling_cache::table::get(const std::string& key,
+                                       const std::function<std::string()>& make) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto found = names.find(key);
+        if (found != names.end()) {
+            ++hit;
+            return found->second;
+        }
+    }
+    // make it without lock, other threads may make the same name too
+    auto res = make();
+    std::lock_guard<std::mutex> lock(mutex);
+    if (names.emplace(key, res).second) {
+        ++miss;
+    } else {
+        ++hit;
+    }
+    return res;
+}
+
 bool llvm_visible_char(char c) {
     return std::isdigit(c) || std::isalpha(c) ||
            c == '_' || c == ':' || c == ' ' || c == ',' ||
@@ -392,4 +415,48 @@ usize levenshtein_distance(const std::string& left, const std::string& right) {
     return v0.back();
 }
 
+static usize worker_thread_count = 0;
+
+usize worker_count() {
+    if (!worker_thread_count) {
+        worker_thread_count = std::max(1u, std::thread::hardware_concurrency());
+    }
+    return worker_thread_count;
+}
+
+void set_worker_count(usize count) {
+    worker_thread_count = std::max<usize>(count, 1);
+}
+
+usize parallel_thread_count(usize count) {
+    return std::min(worker_count(), count);
+}
+
+void parallel_for(usize count, const std::function<void(usize, usize)>& task) {
+    const auto thread_count = parallel_thread_count(count);
+    if (thread_count <= 1) {
+        for (usize i = 0; i < count; ++i) {
+            task(0, i);
+        }
+        return;
+    }
+
+    std::atomic<usize> next(0);
+    auto worker = [&](usize thread) {
+        for (auto i = next++; i < count; i = next++) {
+            task(thread, i);
+        }
+    };
+
+    // calling thread is also a worker
+    std::vector<std::thread> threads;
+    for (usize i = 1; i < thread_count; ++i) {
+        threads.emplace_back(worker, i);
+    }
+    worker(0);
+    for (auto& t : threads) {
+        t.join();
+    }
+}
+
 }
@@ -108,6 +108,12 @@ cond_compile* parse::conditional_compile() {
     match(tok::tk_lbracket);
     auto res = new cond_compile(begin_loc, toks[ptr].str);
     match(tok::tk_id);
+    // attributes like #[inline] have no condition list
+    if (look_ahead(tok::tk_rbracket)) {
+        match(tok::tk_rbracket);
+        update_location(res);
+        return res;
+    }
     match(tok::tk_lcurve);
     while (!look_ahead(tok::tk_rcurve)) {
         auto key = toks[ptr].str;
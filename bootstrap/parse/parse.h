@@ -190,6 +190,12 @@ public:
     ~parse() { delete result; }
     const error& analyse(const std::vector<token>&);
     auto get_result() { return result; }
+    // take ownership of the ast, it will not be deleted with parser
+    auto release_result() {
+        auto res = result;
+        result = nullptr;
+        return res;
+    }
 };
 
 }
@@ -71,11 +71,11 @@ void flstream::load(const std::string& f) {
 
 void error::err(const std::string& info) {
     ++cnt;
-    std::cerr << red << "Error: " << white << info << reset << "\n\n";
+    out() << red << "Error: " << white << info << reset << "\n\n";
 }
 
 void error::warn(const std::string& info) {
-    std::clog << orange << "Warning: " << white << info << reset << "\n\n";
+    out() << orange << "Warning: " << white << info << reset << "\n\n";
 }
 
 void error::err(const span& loc, const std::string& info, const std::string& note) {
@@ -84,14 +84,14 @@ void error::err(const span& loc, const std::string& info, const std::string& not
 
     ++cnt;
 
-    std::cerr
+    out()
     << red << "Error: " << white << info << reset << "\n" << cyan << "  --> "
     << red << loc << reset << "\n";
 
     const usize maxlen = std::to_string(loc.end_line).length();
     const std::string iden = identation(maxlen);
 
-    std::cerr << cyan << iden << " | " << reset << "\n";
+    out() << cyan << iden << " | " << reset << "\n";
 
     for (u32 line = loc.begin_line; line <= loc.end_line; ++line) {
         // skip line 0
@@ -101,8 +101,8 @@ void error::err(const span& loc, const std::string& info, const std::string& not
 
         if (loc.begin_line < line && line < loc.end_line) {
             if (line == loc.begin_line + 1) {
-                std::cerr << cyan << iden << " | " << reset << "...\n";
-                std::cerr << cyan << iden << " | " << reset << "\n";
+                out() << cyan << iden << " | " << reset << "...\n";
+                out() << cyan << iden << " | " << reset << "\n";
             }
             continue;
         }
@@ -118,49 +118,49 @@ void error::err(const span& loc, const std::string& info, const std::string& not
         }
 
         const auto& code = res[line - 1];
-        std::cerr << cyan << leftpad(line, maxlen) << " | " << reset << code << "\n";
+        out() << cyan << leftpad(line, maxlen) << " | " << reset << code << "\n";
         // output underline
-        std::cerr << cyan << iden << " | " << reset;
+        out() << cyan << iden << " | " << reset;
         if (loc.begin_line == loc.end_line) {
             for (u32 i = 0; i < loc.begin_column; ++i) {
-                std::cerr << char(" \t"[code[i] == '\t']);
+                out() << char(" \t"[code[i] == '\t']);
             }
             for (u32 i = loc.begin_column; i < loc.end_column; ++i) {
-                std::cerr << red << (code[i] == '\t' ? "^^^^" : "^") << reset;
+                out() << red << (code[i] == '\t' ? "^^^^" : "^") << reset;
             }
         } else if (line == loc.begin_line) {
             for (u32 i = 0; i < loc.begin_column; ++i) {
-                std::cerr << char(" \t"[code[i] == '\t']);
+                out() << char(" \t"[code[i] == '\t']);
             }
             for (u32 i = loc.begin_column; i < code.size(); ++i) {
-                std::cerr << red << (code[i] == '\t' ? "^^^^" : "^") << reset;
+                out() << red << (code[i] == '\t' ? "^^^^" : "^") << reset;
             }
         } else if (loc.begin_line < line && line < loc.end_line) {
             for (u32 i = 0; i < code.size(); ++i) {
-                std::cerr << red << (code[i] == '\t' ? "^^^^" : "^");
+                out() << red << (code[i] == '\t' ? "^^^^" : "^");
             }
         } else {
             for (u32 i = 0; i < loc.end_column; ++i) {
-                std::cerr << red << (code[i] == '\t' ? "^^^^" : "^");
+                out() << red << (code[i] == '\t' ? "^^^^" : "^");
             }
         }
         if (line == loc.end_line) {
-            std::cerr << reset;
+            out() << reset;
         } else {
-            std::cerr << reset << "\n";
+            out() << reset << "\n";
         }
     }
     if (note.size()) {
-        std::cerr << "\n" << iden << cyan << "note: " << reset << note;
+        out() << "\n" << iden << cyan << "note: " << reset << note;
     }
-    std::cerr << "\n\n";
+    out() << "\n\n";
 }
 
 void error::warn(const span& loc, const std::string& info, const std::string& note) {
     // load error occurred file into string lines
     load(loc.file);
 
-    std::cerr
+    out()
     << orange << "Warning: " << white << info << reset
     << "\n" << cyan << "  --> "
     << orange << loc << reset << "\n";
@@ -176,8 +176,8 @@ void error::warn(const span& loc, const std::string& info, const std::string& no
 
         if (loc.begin_line < line && line < loc.end_line) {
             if (line == loc.begin_line + 1) {
-                std::cerr << cyan << iden << " | " << reset << "...\n";
-                std::cerr << cyan << iden << " | " << reset << "\n";
+                out() << cyan << iden << " | " << reset << "...\n";
+                out() << cyan << iden << " | " << reset << "\n";
             }
             continue;
         }
@@ -193,42 +193,47 @@ void error::warn(const span& loc, const std::string& info, const std::string& no
         }
 
         const auto& code = res[line - 1];
-        std::cerr << cyan << leftpad(line, maxlen) << " | " << reset << code << "\n";
+        out() << cyan << leftpad(line, maxlen) << " | " << reset << code << "\n";
         // output underline
-        std::cerr << cyan << iden << " | " << reset;
+        out() << cyan << iden << " | " << reset;
         if (loc.begin_line == loc.end_line) {
             for (u32 i = 0; i < loc.begin_column; ++i) {
-                std::cerr << char(" \t"[code[i] == '\t']);
+                out() << char(" \t"[code[i] == '\t']);
             }
             for (u32 i = loc.begin_column; i < loc.end_column; ++i) {
-                std::cerr << orange << (code[i] == '\t' ? "^^^^" : "^") << reset;
+                out() << orange << (code[i] == '\t' ? "^^^^" : "^") << reset;
             }
         } else if (line == loc.begin_line) {
             for (u32 i = 0; i < loc.begin_column; ++i) {
-                std::cerr << char(" \t"[code[i] == '\t']);
+                out() << char(" \t"[code[i] == '\t']);
             }
             for (u32 i = loc.begin_column; i < code.size(); ++i) {
-                std::cerr << orange << (code[i] == '\t' ? "^^^^" : "^") << reset;
+                out() << orange << (code[i] == '\t' ? "^^^^" : "^") << reset;
             }
         } else if (loc.begin_line < line && line < loc.end_line) {
             for (u32 i = 0; i<code.size(); ++i) {
-                std::cerr << orange << (code[i] == '\t' ? "^^^^" : "^");
+                out() << orange << (code[i] == '\t' ? "^^^^" : "^");
             }
         } else {
             for (u32 i = 0; i < loc.end_column; ++i) {
-                std::cerr << orange << (code[i] == '\t' ? "^^^^" : "^");
+                out() << orange << (code[i] == '\t' ? "^^^^" : "^");
             }
         }
         if (line == loc.end_line) {
-            std::cerr << reset;
+            out() << reset;
         } else {
-            std::cerr << reset << "\n";
+            out() << reset << "\n";
         }
     }
     if (note.size()) {
-        std::cerr << "\n" << iden << cyan << "note: " << reset << note;
+        out() << "\n" << iden << cyan << "note: " << reset << note;
     }
-    std::cerr << "\n\n";
+    out() << "\n\n";
+}
+
+void error::merge(const error& worker) {
+    out() << worker.buffer.str();
+    cnt += worker.cnt;
 }
 
 }
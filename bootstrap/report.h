@@ -50,6 +50,18 @@ class error: public flstream {
 private:
     u64 cnt; // counter for errors
 
+    // errors reported by worker threads are buffered,
+    // and written out in a stable order by merge
+    bool buffered;
+    std::ostringstream buffer;
+
+    std::ostream& out() {
+        if (buffered) {
+            return buffer;
+        }
+        return std::cerr;
+    }
+
     std::string identation(usize len) {
         return std::string(len, ' ');
     }
@@ -62,12 +74,15 @@ private:
     }
 
 public:
-    error(): cnt(0) {}
+    error(bool buffered_output = false):
+        cnt(0), buffered(buffered_output) {}
     void err(const std::string&);
     void warn(const std::string&);
     void err(const span&, const std::string&, const std::string& note = "");
     void warn(const span&, const std::string&, const std::string& note = "");
 
+    void merge(const error&);
+
     void chkerr() const {
         if (cnt) {
             std::exit(1);
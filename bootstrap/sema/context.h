@@ -3,6 +3,8 @@
 #include "sema/primitive.h"
 #include "sema/type.h"
 #include "package/package.h"
+#include "ast/ast.h"
+#include "ast/decl.h"
 
 #include <cassert>
 #include <unordered_map>
@@ -10,9 +12,17 @@
 #include <cstring>
 #include <sstream>
 #include <vector>
+#include <memory>
 
 namespace colgm {
 
+struct lazy_method {
+    ast::impl* impl;
+    ast::func_decl* method;
+    // module whose ast holds this method
+    std::string owner_file;
+};
+
 struct global_symbol_table {
     // main input file
     std::string input_file;
@@ -25,6 +35,16 @@ struct global_symbol_table {
 
     // store all modules
     std::unordered_map<std::string, colgm_module> domain;
+
+    // methods of generic instances resolved only after referenced, shared
+    // by all modules, key is "domain:struct.method", value is the index of
+    // lazy_methods
+    std::unordered_map<std::string, usize> lazy_index;
+    std::vector<lazy_method> lazy_methods;
+    // ast of analysed modules, kept alive until all lazy methods are used
+    std::vector<std::unique_ptr<ast::root>> retained_root;
+    // resolve and generate all methods of generic instances
+    bool eager_generic = false;
 };
 
 struct sema_context {
@@ -534,6 +534,7 @@ void generic_visitor::replace_struct_type(colgm_struct& s,
         // but now it should be replaced with "foo<int, bool>"
         i->set_name(s.name);
         i->clear_generic_types();
+        i->set_instance(true);
     }
     s.generic_struct_impl.clear();
     return;
@@ -904,7 +905,11 @@ void regist_pass::regist_single_import(ast::use_stmt* node, bool verbose) {
             pkgman->set_analyse_status(file, package_manager::status::analysed);
             return;
         }
-        if (sema.analyse(par.get_result(), verbose).geterr()) {
+        // methods of generic instances in this ast may be used by modules
+        // analysed later, so the ast is kept alive
+        auto module_root = par.release_result();
+        ctx.global.retained_root.emplace_back(module_root);
+        if (sema.analyse(module_root, verbose).geterr()) {
             pkgman->set_analyse_status(file, package_manager::status::analysed);
             return;
         }
@@ -914,7 +919,8 @@ void regist_pass::regist_single_import(ast::use_stmt* node, bool verbose) {
         }
         pkgman->set_analyse_status(file, package_manager::status::analysed);
         // generate mir
-        if (ast2mir.generate(par.get_result()).geterr()) {
+        if (ast2mir.generate(module_root).geterr() ||
+            ast2mir.generate_lazy_methods(sema.get_lazy_foreign()).geterr()) {
             rp.report(node,
                 "error ocurred when generating mir for module \"" + mp + "\""
             );
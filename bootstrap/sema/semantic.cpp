@@ -153,8 +153,22 @@ bool semantic::check_can_be_referenced(node* n) {
              n->is(ast_type::ast_array_list));
 }
 
+void semantic::use_lazy_method(const type& prev, const std::string& fn_name) {
+    // registry is not changed while function bodies are resolved,
+    // so workers only read it, and referenced ones are merged later
+    const auto& lazy_index = ctx.global.lazy_index;
+    if (lazy_index.empty()) {
+        return;
+    }
+    const auto key = prev.loc_file + ":" + prev.generic_name() + "." + fn_name;
+    if (lazy_index.count(key)) {
+        used_lazy_method.push_back(lazy_index.at(key));
+    }
+}
+
 type semantic::struct_static_method_infer(const type& prev,
                                           const std::string& fn_name) {
+    use_lazy_method(prev, fn_name);
     auto infer = prev;
     infer.pointer_depth = 0;
     infer.is_global = true;
@@ -164,6 +178,7 @@ type semantic::struct_static_method_infer(const type& prev,
 
 type semantic::struct_method_infer(const type& prev,
                                    const std::string& fn_name) {
+    use_lazy_method(prev, fn_name);
     auto infer = prev;
     infer.pointer_depth = 0;
     infer.is_global = true;
@@ -468,7 +483,7 @@ type semantic::resolve_number_literal(number_literal* node) {
 }
 
 type semantic::resolve_string_literal(string_literal* node) {
-    ctx.global.constant_string.insert(node->get_string());
+    constant_string.push_back(node->get_string());
     node->set_resolve_type(type::const_str_literal_type());
     return type::const_str_literal_type();
 }
@@ -2506,6 +2521,10 @@ void semantic::resolve_impl(impl* node) {
         : ctx.get_domain(node->get_file());
 
     if (domain.structs.count(node->get_name())) {
+        // resolved on demand
+        if (node->is_generic_instance() && !ctx.global.eager_generic) {
+            return;
+        }
         const auto& struct_self = domain.structs.at(node->get_name());
         impl_struct_name = node->get_name();
         for (auto i : node->get_methods()) {
@@ -2529,14 +2548,115 @@ void semantic::resolve_impl(impl* node) {
     );
 }
 
+// methods of generic struct instances are not resolved here,
+// unused ones are never resolved and not generated by ast2mir,
+// --eager-generic keeps all of them to check the whole library
+void semantic::collect_lazy_methods(root* ast_root) {
+    if (ctx.global.eager_generic) {
+        return;
+    }
+    for (auto i : ast_root->get_decls()) {
+        if (!i->is(ast_type::ast_impl)) {
+            continue;
+        }
+        auto node = reinterpret_cast<impl*>(i);
+        if (!node->is_generic_instance() || node->get_generic_types()) {
+            continue;
+        }
+        const auto& domain_file = node->is_redirected()
+            ? node->get_redirect_location()
+            : node->get_file();
+        if (!ctx.get_domain(domain_file).structs.count(node->get_name())) {
+            continue;
+        }
+        for (auto method : node->get_methods()) {
+            const auto key = domain_file + ":" + node->get_name() + "." +
+                             method->get_name();
+            method->set_lazy(true);
+            ctx.global.lazy_index.insert({key, ctx.global.lazy_methods.size()});
+            ctx.global.lazy_methods.push_back({node, method, ctx.this_file});
+        }
+    }
+}
+
+void semantic::resolve_lazy_method(const lazy_method& m) {
+    const auto& domain = m.impl->is_redirected()
+        ? ctx.get_domain(m.impl->get_redirect_location())
+        : ctx.get_domain(m.impl->get_file());
+    impl_struct_name = m.impl->get_name();
+    resolve_method(m.method, domain.structs.at(m.impl->get_name()));
+    impl_struct_name = "";
+}
+
+// function bodies only read global symbols and write their own ast,
+// so each task is resolved by a worker with its own reporter, then
+// diagnostics, string literals and referenced lazy methods are merged
+// in task order
+std::vector<usize> semantic::resolve_by_workers(
+    usize count, const std::function<void(semantic&, usize)>& task) {
+    std::vector<std::unique_ptr<error>> errors(count);
+    std::vector<std::vector<std::string>> strings(count);
+    std::vector<std::vector<usize>> used(count);
+    parallel_for(count, [&](usize, usize index) {
+        errors[index] = std::make_unique<error>(true);
+        semantic worker(*errors[index]);
+        worker.ctx.this_file = ctx.this_file;
+        task(worker, index);
+        strings[index] = std::move(worker.constant_string);
+        used[index] = std::move(worker.used_lazy_method);
+    });
+
+    std::vector<usize> result;
+    for (usize i = 0; i < count; ++i) {
+        err.merge(*errors[i]);
+        for (const auto& s : strings[i]) {
+            ctx.global.constant_string.insert(s);
+        }
+        result.insert(result.end(), used[i].begin(), used[i].end());
+    }
+    return result;
+}
+
 void semantic::resolve_function_block(root* ast_root) {
+    // registered before this module, their ast2mir is already done
+    const auto lazy_base = ctx.global.lazy_methods.size();
+    collect_lazy_methods(ast_root);
+
+    std::vector<decl*> decls;
     for (auto i : ast_root->get_decls()) {
-        if (i->is(ast_type::ast_impl)) {
-            resolve_impl(reinterpret_cast<impl*>(i));
+        if (i->is(ast_type::ast_impl) || i->is(ast_type::ast_func_decl)) {
+            decls.push_back(i);
         }
-        if (i->is(ast_type::ast_func_decl)) {
-            resolve_global_func(reinterpret_cast<func_decl*>(i));
+    }
+    auto used = resolve_by_workers(decls.size(), [&](semantic& worker, usize index) {
+        auto n = decls[index];
+        if (n->is(ast_type::ast_impl)) {
+            worker.resolve_impl(reinterpret_cast<impl*>(n));
+        } else {
+            worker.resolve_global_func(reinterpret_cast<func_decl*>(n));
+        }
+    });
+
+    // resolve referenced lazy methods round by round, until no new
+    // lazy method is referenced
+    while (!used.empty()) {
+        std::vector<usize> queue;
+        for (auto index : used) {
+            const auto& m = ctx.global.lazy_methods[index];
+            if (!m.method->is_lazy_method()) {
+                continue;
+            }
+            m.method->set_lazy(false);
+            queue.push_back(index);
+            if (index < lazy_base) {
+                lazy_foreign.push_back(index);
+            }
         }
+        used = resolve_by_workers(queue.size(), [&](semantic& worker, usize index) {
+            const auto& m = ctx.global.lazy_methods[queue[index]];
+            worker.ctx.this_file = m.owner_file;
+            worker.resolve_lazy_method(m);
+        });
     }
 }
 
@@ -15,6 +15,8 @@
 #include "sema/type_resolver.h"
 
 #include <unordered_map>
+#include <functional>
+#include <memory>
 #include <cstring>
 #include <sstream>
 #include <vector>
@@ -35,6 +37,13 @@ private:
     type_resolver tr;
     i64 in_loop_level = 0;
     std::string impl_struct_name;
+    // string literals found in function bodies
+    std::vector<std::string> constant_string;
+    // lazy methods referenced by function bodies, index of lazy_methods
+    std::vector<usize> used_lazy_method;
+    // lazy methods of modules analysed before but first referenced by
+    // this module, ast2mir generates them after this module
+    std::vector<usize> lazy_foreign;
 
 private:
     void report_unreachable_statements(code_block*);
@@ -48,6 +57,7 @@ private:
     bool check_can_be_referenced(node*);
 
 private:
+    void use_lazy_method(const type&, const std::string&);
     type struct_static_method_infer(const type&, const std::string&);
     type struct_method_infer(const type&, const std::string&);
 
@@ -132,6 +142,10 @@ private:
     void resolve_method(func_decl*, const colgm_struct&);
     void resolve_method(func_decl*, const colgm_union&);
     void resolve_impl(impl*);
+    void collect_lazy_methods(root*);
+    void resolve_lazy_method(const lazy_method&);
+    std::vector<usize> resolve_by_workers(
+        usize, const std::function<void(semantic&, usize)>&);
     void resolve_function_block(root*);
 
 public:
@@ -144,6 +158,10 @@ public:
     void set_main_input_file(const std::string& input_file) {
         ctx.global.input_file = input_file;
     }
+    void set_eager_generic(bool b) {
+        ctx.global.eager_generic = b;
+    }
+    const auto& get_lazy_foreign() const { return lazy_foreign; }
 };
 
 }
\ No newline at end of file
@@ -67,6 +67,13 @@ std::string type::full_path_name() const {
     return module_name + "::" + generic_name();
 }
 
+std::string type::mangled_name() const {
+    return mangling_cache::singleton().type_names.get(
+        loc_file + "|" + generic_name(),
+        [&]() { return mangle(full_path_name()); }
+    );
+}
+
 std::string type::full_path_name_with_pointer() const {
     auto result = full_path_name();
     for (i64 i = 0; i < pointer_depth; ++i) {
@@ -84,6 +84,8 @@ public:
     std::string array_type_to_string() const;
     std::string full_path_name() const;
     std::string full_path_name_with_pointer() const;
+    // mangled full path name, memoized by mangling_cache
+    std::string mangled_name() const;
     // type name with generic info, without pointer info, without module info
     std::string generic_name() const;
     u64 generic_depth() const;
@@ -3,11 +3,12 @@
 namespace colgm {
 
 void adjust_va_arg_func::adjust(sir_call* call) {
-    if (call->get_name() != "open") {
+    const auto& funcs = mir::variadic_libc_funcs;
+    if (!funcs.count(call->get_name())) {
         return;
     }
     call->set_with_va_args(true);
-    call->set_with_va_args_real_param_size(2);
+    call->set_with_va_args_real_param_size(funcs.at(call->get_name()));
 }
 
 void adjust_va_arg_func::adjust_basic_block(sir_basic_block* block) {
@@ -19,22 +20,11 @@ void adjust_va_arg_func::adjust_basic_block(sir_basic_block* block) {
     }
 }
 
-void adjust_va_arg_func::adjust_posix_open(sir_context* ctx) {
-    // On most platforms, open uses 3 registers to pass the arguments,
-    // but on macOS aarch64, the third argument is passed on stack.
-    // If we use `open(i8*, i32, i32);`, macOS target executable will malfunction.
-    // So we change open to open(i8*, i32, ...) on all the platforms
-    // to make sure the third argument functioning properly
-    for (auto i : ctx->func_impls) {
-        for (auto s : i->get_code_block()->get_basic_blocks()) {
-            adjust_basic_block(s);
-        }
+u64 adjust_va_arg_func::run_on_func(sir_func* func) {
+    for (auto s : func->get_code_block()->get_basic_blocks()) {
+        adjust_basic_block(s);
     }
-}
-
-bool adjust_va_arg_func::run(sir_context* ctx) {
-    adjust_posix_open(ctx);
-    return true;
+    return 0;
 }
 
 }
\ No newline at end of file
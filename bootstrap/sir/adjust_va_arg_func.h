@@ -2,23 +2,23 @@
 
 #include "report.h"
 #include "sir/pass_manager.h"
+#include "mir/adjust_va_arg_func.h"
 
 #include <cstring>
 #include <sstream>
 
 namespace colgm {
 
-class adjust_va_arg_func: public sir_pass {
+class adjust_va_arg_func: public sir_func_pass {
 private:
     error err;
 
 private:
     void adjust(sir_call*);
     void adjust_basic_block(sir_basic_block*);
-    void adjust_posix_open(sir_context*);
 
 public:
-    adjust_va_arg_func(): sir_pass() {}
+    adjust_va_arg_func(): sir_func_pass() {}
     ~adjust_va_arg_func() override = default;
     std::string name() override {
         return "adjust va_arg func";
@@ -26,7 +26,7 @@ public:
     std::string info() override {
         return "passed";
     }
-    bool run(sir_context*) override;
+    u64 run_on_func(sir_func*) override;
 };
 
 }
\ No newline at end of file
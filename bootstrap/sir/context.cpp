@@ -30,7 +30,7 @@ const auto sir_struct::get_mangled_name() const {
         .name = name,
         .loc_file = location.file
     };
-    return quoted_name("struct." + mangle(ty.full_path_name()));
+    return quoted_name("struct." + ty.mangled_name());
 }
 
 void sir_struct::dump(std::ostream& out) const {
@@ -54,16 +54,17 @@ const auto sir_union::get_mangled_name() const {
         .name = name,
         .loc_file = location.file
     };
-    return quoted_name("union." + mangle(ty.full_path_name()));
+    return quoted_name("union." + ty.mangled_name());
 }
 
 void sir_union::dump(std::ostream& out) const {
     out << "%" << get_mangled_name();
     if (member_type.empty()) {
-        out << " = type { i64 } ; size " << size << " align " << align << "\n";
+        out << " = type { " << tag_type << " } ; size " << size;
+        out << " align " << align << "\n";
         return;
     }
-    out << " = type { i64, ";
+    out << " = type { " << tag_type << ", ";
     for (usize i = 0; i<member_type.size(); ++i) {
         out << quoted_name(member_type[i]);
         if (i != member_type.size()-1) {
@@ -187,7 +188,7 @@ void sir_context::dump_size_method(std::ostream& out) const {
             .name = st->get_name(),
             .loc_file = st->get_file()
         };
-        const auto st_name = mangle(st_type.full_path_name());
+        const auto st_name = st_type.mangled_name();
         const auto size_func_name = quoted_name(st_name + ".__size__");
         out << "define i64 @" << size_func_name << "() alwaysinline {\n";
         out << "  ret i64 " << st->get_size() << "\n}\n\n";
@@ -198,7 +199,7 @@ void sir_context::dump_size_method(std::ostream& out) const {
             .name = un->get_name(),
             .loc_file = un->get_file()
         };
-        const auto un_name = mangle(un_type.full_path_name());
+        const auto un_name = un_type.mangled_name();
         const auto size_func_name = quoted_name(un_name + ".__size__");
         out << "define i64 @" << size_func_name << "() alwaysinline {\n";
         out << "  ret i64 " << un->get_size() << "\n}\n\n";
@@ -211,7 +212,7 @@ void sir_context::dump_alloc_method(std::ostream& out) const {
             .name = st->get_name(),
             .loc_file = st->get_file()
         };
-        const auto st_name = mangle(st_type.full_path_name());
+        const auto st_name = st_type.mangled_name();
         const auto st_real_name = quoted_name("%struct." + st_name);
         const auto alloc_func_name = quoted_name(st_name + ".__alloc__");
         out << "define ptr @" << alloc_func_name;
@@ -227,7 +228,7 @@ void sir_context::dump_alloc_method(std::ostream& out) const {
             .name = un->get_name(),
             .loc_file = un->get_file()
         };
-        const auto un_name = mangle(un_type.full_path_name());
+        const auto un_name = un_type.mangled_name();
         const auto un_real_name = quoted_name("%union." + un_name);
         const auto alloc_func_name = quoted_name(un_name + ".__alloc__");
         out << "define ptr @" << alloc_func_name;
@@ -40,6 +40,7 @@ class sir_union {
 private:
     std::string name;
     span location;
+    std::string tag_type;
     std::vector<std::string> member_type;
     u64 size;
     u64 align;
@@ -47,9 +48,10 @@ private:
 public:
     sir_union(const std::string& n,
                      const span& loc,
+                     const std::string& t,
                      u64 s,
                      u64 a):
-        name(n), location(loc), size(s), align(a) {}
+        name(n), location(loc), tag_type(t), size(s), align(a) {}
     const auto get_mangled_name() const;
     void dump(std::ostream&) const;
     const auto& get_name() const { return name; }
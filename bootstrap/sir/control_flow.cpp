@@ -55,17 +55,20 @@ void control_flow_analysis::analyze_basic_block(sir_basic_block* bb, sir_block*
     }
 }
 
-bool control_flow_analysis::run(sir_context* ctx) {
-    for (auto& func : ctx->func_impls) {
-        for (auto bb : func->get_code_block()->get_basic_blocks()) {
-            bb->get_preds().clear();
-            bb->get_succs().clear();
-        }
+void control_flow_analysis::analyze_func(sir_func* func) {
+    for (auto bb : func->get_code_block()->get_basic_blocks()) {
+        bb->get_preds().clear();
+        bb->get_succs().clear();
     }
-    for (auto& func : ctx->func_impls) {
-        for (auto bb : func->get_code_block()->get_basic_blocks()) {
-            analyze_basic_block(bb, func->get_code_block());
-        }
+    for (auto bb : func->get_code_block()->get_basic_blocks()) {
+        analyze_basic_block(bb, func->get_code_block());
+    }
+}
+
+bool control_flow_analysis::run(sir_context* ctx) {
+    // branches only jump to blocks in the same function
+    for (auto func : ctx->func_impls) {
+        analyze_func(func);
     }
     return true;
 }
@@ -11,6 +11,7 @@ private:
 
 public:
     control_flow_analysis(): sir_pass() {}
+    void analyze_func(sir_func*);
     ~control_flow_analysis() override = default;
     std::string name() override {
         return "control flow analysis";
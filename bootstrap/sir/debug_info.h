@@ -49,6 +49,8 @@ public:
     bool is(DI_kind k) {
         return kind == k;
     }
+    auto get_index() const { return index; }
+    void set_index(u64 i) { index = i; }
 };
 
 class DI_null: public DI_node {
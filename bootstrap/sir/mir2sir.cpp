@@ -2,6 +2,7 @@
 
 #include <fstream>
 #include <cassert>
+#include <memory>
 
 namespace colgm::mir {
 
@@ -33,6 +34,13 @@ void mir2sir::generate_type_mapper() {
 }
 
 std::string mir2sir::type_mapping(const type& t) {
+    return mangling_cache::singleton().llvm_type_names.get(
+        t.loc_file + "|" + t.to_string(),
+        [&]() { return map_type(t); }
+    );
+}
+
+std::string mir2sir::map_type(const type& t) {
     auto copy = t;
     // basic type mapping
     if (basic_type_mapper.count(copy.name)) {
@@ -47,7 +55,7 @@ std::string mir2sir::type_mapping(const type& t) {
     }
     switch(type_mapper.at(full_name)) {
         case sym_kind::struct_kind:
-            copy.name = "%struct." + mangle(full_name);
+            copy.name = "%struct." + t.mangled_name();
             // need to clear loc_file info
             // otherwise for example:
             // std::vec<data::foo>
@@ -71,7 +79,7 @@ std::string mir2sir::type_mapping(const type& t) {
             copy.generics.clear();
             break;
         case sym_kind::union_kind:
-            copy.name = "%union." + mangle(full_name);
+            copy.name = "%union." + t.mangled_name();
             break;
         case sym_kind::enum_kind:
             // should copy pointer depth too
@@ -95,6 +103,7 @@ void mir2sir::emit_union(const mir_context& mctx) {
         auto tud = new sir_union(
             i->name,
             i->location,
+            "i" + std::to_string(i->tag_size * 8),
             i->total_size,
             i->align
         );
@@ -136,77 +145,160 @@ void mir2sir::emit_func_decl(const mir_context& mctx) {
     }
 }
 
-void mir2sir::emit_func_impl(const mir_context& mctx) {
-    for (auto i : mctx.impls) {
-        auto func = new sir_func(i->name, i->location);
-        func->set_attributes(i->attributes);
-        func->set_return_type(type_mapping(i->return_type));
-        // push local scope
-        locals.push();
-        // load parameters and locals
-        for (const auto& j : i->params) {
-            func->add_param(j.first + ".param", type_mapping(j.second));
-            locals.elem.back().insert({j.first, j.first});
-        }
-        func->set_with_va_args(i->with_va_args);
-        // if having debug info, set it
-        if (dwarf_status.impl_debug_info.count(i->name)) {
-            auto scope = dwarf_status.impl_debug_info.at(i->name);
-            func->set_debug_info_index(scope);
-            dwarf_status.scope_index = scope;
-        } else {
-            dwarf_status.scope_index = DI_node::DI_ERROR_INDEX;
-        }
+std::unique_ptr<mir2sir> mir2sir::create_worker() const {
+    auto worker = std::make_unique<mir2sir>(ctx);
+    worker->type_mapper = type_mapper;
+    worker->struct_mapper = struct_mapper;
+    worker->union_mapper = union_mapper;
+    worker->dwarf_status = dwarf_status;
+    return worker;
+}
 
-        // generate code block
-        func->set_code_block(new sir_block);
+mir2sir::lowered_func mir2sir::lower_func_impl(mir_func* i) {
+    // strings and debug info are numbered from 0 in each function,
+    // and rebased when merged into the module
+    err = error(true);
+    ictx.const_strings.clear();
+    dwarf_status.DI_counter = 0;
 
-        // init ssa generator
-        ssa_gen.clear();
-        array_ssa_gen.clear();
-        var_ssa_gen.clear();
-        label_gen.clear();
+    auto func = new sir_func(i->name, i->location);
+    func->set_attributes(i->attributes);
+    func->set_return_type(type_mapping(i->return_type));
+    // push local scope
+    locals.push();
+    // load parameters and locals
+    for (const auto& j : i->params) {
+        func->add_param(j.first + ".param", type_mapping(j.second));
+        locals.elem.back().insert({j.first, j.first});
+    }
+    func->set_with_va_args(i->with_va_args);
+    // if having debug info, set it
+    if (dwarf_status.impl_debug_info.count(i->name)) {
+        auto scope = dwarf_status.impl_debug_info.at(i->name);
+        func->set_debug_info_index(scope);
+        dwarf_status.scope_index = scope;
+    } else {
+        dwarf_status.scope_index = DI_node::DI_ERROR_INDEX;
+    }
 
-        // clear value stack
-        value_stack.clear();
+    // generate code block
+    func->set_code_block(new sir_block);
 
-        func_block = func->get_code_block();
+    // init ssa generator
+    ssa_gen.clear();
+    array_ssa_gen.clear();
+    var_ssa_gen.clear();
+    label_gen.clear();
 
-        alloca_block = new sir_basic_block(label_gen.create_index());
-        move_reg_block = new sir_basic_block(label_gen.create_index());
-        block = new sir_basic_block(label_gen.create_index());
-        auto entry = block->get_label_num();
+    // clear value stack
+    value_stack.clear();
 
-        func_block->add_basic_block(alloca_block);
-        func_block->add_basic_block(move_reg_block);
-        func_block->add_basic_block(block);
+    func_block = func->get_code_block();
 
-        for (const auto& j : i->params) {
-            alloca_block->add_stmt(new sir_alloca(j.first, type_mapping(j.second)));
-            block->add_stmt(new sir_store(
-                type_mapping(j.second),
-                value_t::variable(j.first + ".param"),
-                value_t::variable(j.first),
-                DI_node::DI_ERROR_INDEX
-            ));
-        }
-        // visit mir and generate sir
-        i->block->accept(this);
+    alloca_block = new sir_basic_block(label_gen.create_index());
+    move_reg_block = new sir_basic_block(label_gen.create_index());
+    block = new sir_basic_block(label_gen.create_index());
+    auto entry = block->get_label_num();
+
+    func_block->add_basic_block(alloca_block);
+    func_block->add_basic_block(move_reg_block);
+    func_block->add_basic_block(block);
+
+    for (const auto& j : i->params) {
+        alloca_block->add_stmt(new sir_alloca(j.first, type_mapping(j.second)));
+        block->add_stmt(new sir_store(
+            type_mapping(j.second),
+            value_t::variable(j.first + ".param"),
+            value_t::variable(j.first),
+            DI_node::DI_ERROR_INDEX
+        ));
+    }
+    // visit mir and generate sir
+    i->block->accept(this);
 
-        // create br inst
-        alloca_block->add_stmt(new sir_br(move_reg_block->get_label_num()));
-        move_reg_block->add_stmt(new sir_br(entry));
+    // create br inst
+    alloca_block->add_stmt(new sir_br(move_reg_block->get_label_num()));
+    move_reg_block->add_stmt(new sir_br(entry));
 
-        // clear block pointer
-        func_block = nullptr;
-        alloca_block = nullptr;
-        move_reg_block = nullptr;
-        block = nullptr;
+    // clear block pointer
+    func_block = nullptr;
+    alloca_block = nullptr;
+    move_reg_block = nullptr;
+    block = nullptr;
+
+    // pop local scope
+    locals.pop();
+
+    lowered_func res;
+    res.func = func;
+    res.err = std::move(err);
+    res.const_strings.resize(ictx.const_strings.size());
+    for (const auto& s : ictx.const_strings) {
+        res.const_strings[s.second] = s.first;
+    }
+    res.debug_info = std::move(ictx.debug_info);
+    ictx.debug_info.clear();
+    return res;
+}
+
+void mir2sir::merge_func_impl(lowered_func& res) {
+    err.merge(res.err);
+
+    std::vector<usize> string_index;
+    for (const auto& s : res.const_strings) {
+        if (!ictx.const_strings.count(s)) {
+            ictx.const_strings.insert({s, ictx.const_strings.size()});
+        }
+        string_index.push_back(ictx.const_strings.at(s));
+    }
+
+    const auto DI_base = dwarf_status.DI_counter;
+    for (auto i : res.debug_info) {
+        i->set_index(i->get_index() + DI_base);
+        ictx.debug_info.push_back(i);
+    }
+    dwarf_status.DI_counter += res.debug_info.size();
+
+    for (auto bb : res.func->get_code_block()->get_basic_blocks()) {
+        for (auto i : bb->get_stmts()) {
+            switch (i->get_ir_type()) {
+                case sir_kind::sir_str: {
+                    auto str = static_cast<sir_string*>(i);
+                    str->set_index(string_index[str->get_index()]);
+                    break;
+                }
+                case sir_kind::sir_call: {
+                    auto call = static_cast<sir_call*>(i);
+                    call->rebase_debug_info_index(DI_base);
+                    break;
+                }
+                case sir_kind::sir_store: {
+                    auto store = static_cast<sir_store*>(i);
+                    store->rebase_debug_info_index(DI_base);
+                    break;
+                }
+                default: break;
+            }
+        }
+    }
+    ictx.func_impls.push_back(res.func);
+}
 
-        ictx.func_impls.push_back(func);
+void mir2sir::emit_func_impl(const mir_context& mctx) {
+    // functions are lowered independently by workers, then merged in
+    // order, so numbering of strings and debug info is stable
+    const auto thread_count = parallel_thread_count(mctx.impls.size());
+    std::vector<std::unique_ptr<mir2sir>> workers;
+    for (usize i = 0; i < thread_count; ++i) {
+        workers.push_back(create_worker());
+    }
 
-        // pop local scope
-        locals.pop();
+    std::vector<lowered_func> result(mctx.impls.size());
+    parallel_for(mctx.impls.size(), [&](usize thread, usize index) {
+        result[index] = workers[thread]->lower_func_impl(mctx.impls[index]);
+    });
+    for (auto& i : result) {
+        merge_func_impl(i);
     }
 }
 
@@ -779,7 +871,7 @@ void mir2sir::visit_mir_struct_init(mir_struct_init* node) {
                 0
             ));
             block->add_stmt(new sir_store(
-                "i64",
+                union_tag_type(node->get_type()),
                 value_t::literal(std::to_string(un.member_int_map.at(i.name))),
                 value_t::variable(tag),
                 generate_DI_location(node->get_location())
@@ -850,7 +942,7 @@ void mir2sir::push_global_func(const type& t) {
         .generics = t.generics
     };
     value_stack.push_back(mir_value_t::func_kind(
-        mangle(tmp.full_path_name()),
+        mangling_cache::singleton().function_name(tmp.full_path_name()),
         t
     ));
 }
@@ -969,13 +1061,13 @@ void mir2sir::visit_mir_call_func(mir_call_func* node) {
     if (node->get_type() != type::void_type()) {
         target = ssa_gen.create();
         sir_function_call = new sir_call(
-            mangle(prev.content),
+            mangling_cache::singleton().function_name(prev.content),
             type_mapping(node->get_type()),
             value_t::variable(target)
         );
     } else {
         sir_function_call = new sir_call(
-            mangle(prev.content),
+            mangling_cache::singleton().function_name(prev.content),
             type_mapping(node->get_type()),
             value_t::null()
         );
@@ -1621,12 +1713,14 @@ void mir2sir::visit_mir_switch(mir_switch* node) {
                 0
             ));
         }
+        const auto tag_type = union_tag_type(value.resolve_type);
         block->add_stmt(new sir_load(
-            "i64",
+            tag_type,
             value_t::variable(tag),
             value_t::variable(tag_value)
         ));
         switch_inst = new sir_switch(value_t::variable(tag_value));
+        switch_inst->set_type(tag_type);
     } else {
         switch_inst = new sir_switch(value.to_value_t());
     }
@@ -1963,7 +2057,7 @@ void mir2sir::generate_DI_enum_type() {
                 .name = e.second.name,
                 .loc_file = e.second.location.file
             };
-            const auto id = mangle(ty.full_path_name());
+            const auto id = ty.mangled_name();
             auto tmp = new DI_enum_type(
                 dwarf_status.DI_counter,
                 e.second.name,
@@ -2001,7 +2095,7 @@ void mir2sir::generate_DI_structure_type(const mir_context& mctx) {
             .name = i->name,
             .loc_file = i->location.file
         };
-        const auto id = "struct." + mangle(ty.full_path_name());
+        const auto id = "struct." + ty.mangled_name();
         auto tmp = new DI_structure_type(
             dwarf_status.DI_counter,
             i->name,
@@ -2139,6 +2233,22 @@ mir2sir::size_align_pair mir2sir::calculate_size_and_align(const type& ty) {
     };
 }
 
+std::string mir2sir::union_tag_type(const type& t) {
+    return "i" + std::to_string(union_mapper.at(t.full_path_name())->tag_size * 8);
+}
+
+void mir2sir::calculate_tag_size(mir_union* u) {
+    if (u->tag_min >= INT8_MIN && u->tag_max <= INT8_MAX) {
+        u->tag_size = 1;
+    } else if (u->tag_min >= INT16_MIN && u->tag_max <= INT16_MAX) {
+        u->tag_size = 2;
+    } else if (u->tag_min >= INT32_MIN && u->tag_max <= INT32_MAX) {
+        u->tag_size = 4;
+    } else {
+        u->tag_size = 8;
+    }
+}
+
 void mir2sir::calculate_single_union_size(mir_union* u) {
     if (u->size_calculated) {
         return;
@@ -2149,11 +2259,14 @@ void mir2sir::calculate_single_union_size(mir_union* u) {
         return;
     }
 
-    u64 offset = 8;
-    u64 union_align = 8;
+    calculate_tag_size(u);
+
+    // members are placed after the tag
+    u64 offset = u->tag_size;
+    u64 union_align = u->tag_size;
 
     u64 max_size = 0;
-    u64 max_align = 1;
+    u64 max_align = 0;
     for (const auto& i : u->member_type) {
         auto res = calculate_size_and_align(i);
         if (max_size < res.size) {
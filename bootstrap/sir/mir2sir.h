@@ -10,6 +10,7 @@
 #include "sir/context.h"
 
 #include <unordered_map>
+#include <memory>
 #include <cstring>
 #include <sstream>
 #include <vector>
@@ -177,6 +178,7 @@ private:
         {"void", "void"},
         {"bool", "i1"}
     };
+    std::string map_type(const type&);
     std::string type_mapping(const type&);
     std::string array_type_mapping(const type&);
 
@@ -222,6 +224,19 @@ private:
     void emit_func_decl(const mir_context&);
     void emit_func_impl(const mir_context&);
 
+private:
+    // function lowered by a worker, string literals and debug info
+    // are numbered locally and rebased by merge_func_impl
+    struct lowered_func {
+        sir_func* func = nullptr;
+        error err;
+        std::vector<std::string> const_strings;
+        std::vector<DI_node*> debug_info;
+    };
+    std::unique_ptr<mir2sir> create_worker() const;
+    lowered_func lower_func_impl(mir_func*);
+    void merge_func_impl(lowered_func&);
+
 private:
     void generate_and(mir_binary*);
     void generate_or(mir_binary*);
@@ -280,6 +295,9 @@ public:
 
 private:
     size_align_pair calculate_size_and_align(const type&);
+    // tag of union uses the smallest integer holding all tag values
+    std::string union_tag_type(const type&);
+    void calculate_tag_size(mir_union*);
     void calculate_single_union_size(mir_union*);
     void calculate_single_struct_size(mir_struct*);
     void calculate_size(const mir_context&);
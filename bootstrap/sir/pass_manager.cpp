@@ -9,12 +9,43 @@
 
 namespace colgm {
 
+bool sir_func_pass::run(sir_context* ctx) {
+    for (auto i : ctx->func_impls) {
+        count += run_on_func(i);
+    }
+    return true;
+}
+
 sir_pass_manager::~sir_pass_manager() {
     for (auto i : passes) {
         delete i;
     }
 }
 
+void sir_pass_manager::run_func_pipeline(sir_context* sctx,
+                                         const std::vector<sir_func_pass*>& pipeline) {
+    const auto& funcs = sctx->func_impls;
+    // statistics of function i and pass j is stored in i * pipeline.size() + j
+    std::vector<u64> counts(funcs.size() * pipeline.size(), 0);
+    parallel_for(funcs.size(), [&](usize, usize index) {
+        for (usize j = 0; j < pipeline.size(); ++j) {
+            counts[index * pipeline.size() + j] = pipeline[j]->run_on_func(funcs[index]);
+        }
+    });
+
+    for (usize i = 0; i < funcs.size(); ++i) {
+        for (usize j = 0; j < pipeline.size(); ++j) {
+            pipeline[j]->add_count(counts[i * pipeline.size() + j]);
+        }
+    }
+}
+
+void sir_pass_manager::report(sir_pass* pass) {
+    std::clog << "  " << green << "SIR" << reset;
+    std::clog << " run pass " << cyan << "<" << pass->name() << ">" << reset;
+    std::clog << ": " << pass->info() << "\n";
+}
+
 bool sir_pass_manager::execute(sir_context* sctx, bool verbose) {
     passes.push_back(new adjust_va_arg_func);
     passes.push_back(new detect_redef_extern);
@@ -23,20 +54,33 @@ bool sir_pass_manager::execute(sir_context* sctx, bool verbose) {
     passes.push_back(new remove_no_pred_block);
     passes.push_back(new merge_block_with_no_cond_br);
 
-    bool success = true;
-    for (auto i : passes) {
-        if (!i->run(sctx)) {
-            success = false;
-            break;
+    usize index = 0;
+    while (index < passes.size()) {
+        if (!passes[index]->is_func_pass()) {
+            if (!passes[index]->run(sctx)) {
+                return false;
+            }
+            if (verbose) {
+                report(passes[index]);
+            }
+            ++index;
+            continue;
+        }
+
+        std::vector<sir_func_pass*> pipeline;
+        while (index < passes.size() && passes[index]->is_func_pass()) {
+            pipeline.push_back(static_cast<sir_func_pass*>(passes[index]));
+            ++index;
         }
+        run_func_pipeline(sctx, pipeline);
         if (verbose) {
-            std::clog << "  " << green << "SIR" << reset;
-            std::clog << " run pass " << cyan << "<" << i->name() << ">" << reset;
-            std::clog << ": " << i->info() << "\n";
+            for (auto i : pipeline) {
+                report(i);
+            }
         }
     }
 
-    return success;
+    return true;
 }
 
 }
\ No newline at end of file
@@ -15,12 +15,34 @@ public:
     virtual std::string name() = 0;
     virtual std::string info() = 0;
     virtual bool run(sir_context*) = 0;
+    virtual bool is_func_pass() const { return false; }
+};
+
+// function pass only reads and changes the function given to it,
+// consecutive function passes are run on one function back to back,
+// and different functions may be run on worker threads at the same time
+class sir_func_pass: public sir_pass {
+protected:
+    // statistics of all functions, added up after workers finish
+    u64 count = 0;
+
+public:
+    // called by worker threads, should not change the pass itself,
+    // return statistics of this function
+    virtual u64 run_on_func(sir_func*) = 0;
+    bool run(sir_context*) override;
+    bool is_func_pass() const override { return true; }
+    void add_count(u64 c) { count += c; }
 };
 
 class sir_pass_manager {
 private:
     std::vector<sir_pass*> passes;
 
+private:
+    void run_func_pipeline(sir_context*, const std::vector<sir_func_pass*>&);
+    void report(sir_pass*);
+
 public:
     ~sir_pass_manager();
     bool execute(sir_context*, bool);
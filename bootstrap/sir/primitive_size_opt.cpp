@@ -2,7 +2,8 @@
 
 namespace colgm {
 
-void primitive_size_opt::remove_primitive_size_method(sir_basic_block* b) {
+u64 primitive_size_opt::remove_primitive_size_method(sir_basic_block* b) {
+    u64 replace_count = 0;
     std::vector<sir*> new_stmts = {};
     for (auto i : b->get_stmts()) {
         if (i->get_ir_type() != sir_kind::sir_call) {
@@ -25,15 +26,15 @@ void primitive_size_opt::remove_primitive_size_method(sir_basic_block* b) {
         }
     }
     b->get_mut_stmts() = new_stmts;
+    return replace_count;
 }
 
-bool primitive_size_opt::run(sir_context* ctx) {
-    for (auto i : ctx->func_impls) {
-        for (auto j : i->get_code_block()->get_basic_blocks()) {
-            remove_primitive_size_method(j);
-        }
+u64 primitive_size_opt::run_on_func(sir_func* func) {
+    u64 replace_count = 0;
+    for (auto i : func->get_code_block()->get_basic_blocks()) {
+        replace_count += remove_primitive_size_method(i);
     }
-    return true;
+    return replace_count;
 }
 
 }
\ No newline at end of file
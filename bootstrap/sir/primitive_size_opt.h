@@ -9,7 +9,7 @@
 
 namespace colgm {
 
-class primitive_size_opt: public sir_pass {
+class primitive_size_opt: public sir_func_pass {
 private:
     std::unordered_map<std::string, std::string> primitive_methods = {
         {"i8.__size__", "1"}, {"i16.__size__", "2"},
@@ -19,24 +19,23 @@ private:
         {"f32.__size__", "4"}, {"f64.__size__", "8"},
         {"bool.__size__", "1"}
     };
-    u64 replace_count;
 
 private:
-    void remove_primitive_size_method(sir_basic_block*);
+    u64 remove_primitive_size_method(sir_basic_block*);
 
 public:
-    primitive_size_opt(): sir_pass(), replace_count(0) {}
+    primitive_size_opt(): sir_func_pass() {}
     ~primitive_size_opt() override = default;
     std::string name() override {
         return "primitive size opt";
     }
     std::string info() override {
         return "replace " +
-               std::to_string(replace_count) +
+               std::to_string(count) +
                " primitive size method call" +
-               (replace_count > 1 ? "s" : "");
+               (count > 1 ? "s" : "");
     }
-    bool run(sir_context*) override;
+    u64 run_on_func(sir_func*) override;
 };
 
 }
\ No newline at end of file
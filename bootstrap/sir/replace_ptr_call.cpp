@@ -4,13 +4,8 @@
 
 namespace colgm {
 
-void replace_ptr_call::do_remove(sir_block* b) {
-    for (auto i : b->get_basic_blocks()) {
-        do_remove(i);
-    }
-}
-
-void replace_ptr_call::do_remove(sir_basic_block* b) {
+u64 replace_ptr_call::do_remove(sir_basic_block* b) {
+    u64 replace_count = 0;
     std::vector<sir*> new_stmts = {};
     for (auto i : b->get_stmts()) {
         if (i->get_ir_type() != sir_kind::sir_call) {
@@ -38,15 +33,15 @@ void replace_ptr_call::do_remove(sir_basic_block* b) {
         }
     }
     b->get_mut_stmts() = new_stmts;
+    return replace_count;
 }
 
-bool replace_ptr_call::run(sir_context* ctx) {
-    for (auto i : ctx->func_impls) {
-        for (auto j : i->get_code_block()->get_basic_blocks()) {
-            do_remove(j);
-        }
+u64 replace_ptr_call::run_on_func(sir_func* func) {
+    u64 replace_count = 0;
+    for (auto i : func->get_code_block()->get_basic_blocks()) {
+        replace_count += do_remove(i);
     }
-    return true;
+    return replace_count;
 }
 
 }
\ No newline at end of file
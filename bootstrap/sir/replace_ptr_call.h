@@ -7,26 +7,22 @@
 
 namespace colgm {
 
-class replace_ptr_call: public sir_pass {
+class replace_ptr_call: public sir_func_pass {
 private:
-    u64 replace_count;
-
-private:
-    void do_remove(sir_block*);
-    void do_remove(sir_basic_block*);
+    u64 do_remove(sir_basic_block*);
 
 public:
-    replace_ptr_call(): sir_pass(), replace_count(0) {}
+    replace_ptr_call(): sir_func_pass() {}
     ~replace_ptr_call() override = default;
     std::string name() override {
         return "replace __ptr__ call";
     }
     std::string info() override {
-        return std::to_string(replace_count) +
+        return std::to_string(count) +
                " replacement" +
-               (replace_count > 1 ? "s" : "");
+               (count > 1 ? "s" : "");
     }
-    bool run(sir_context*) override;
+    u64 run_on_func(sir_func*) override;
 };
 
 }
\ No newline at end of file
@@ -44,26 +44,19 @@ u64 remove_no_pred_block::do_single_remove(sir_func* func) {
     return count;
 }
 
-u64 remove_no_pred_block::iter_do_remove(sir_context* ctx) {
-    u64 count = 0;
-    for (auto func : ctx->func_impls) {
-        count += do_single_remove(func);
-    }
-    return count;
-}
-
-bool remove_no_pred_block::run(sir_context* ctx) {
+u64 remove_no_pred_block::run_on_func(sir_func* func) {
+    u64 remove_count = 0;
     auto cfa = control_flow_analysis();
-    cfa.run(ctx);
+    cfa.analyze_func(func);
     while (true) {
-        auto count = iter_do_remove(ctx);
+        auto count = do_single_remove(func);
         if (!count) {
             break;
         }
-        cfa.run(ctx);
+        cfa.analyze_func(func);
         remove_count += count;
     }
-    return true;
+    return remove_count;
 }
 
 u64 merge_block_with_no_cond_br::do_single_merge(sir_func* func) {
@@ -129,26 +122,19 @@ u64 merge_block_with_no_cond_br::do_single_merge(sir_func* func) {
     return count;
 }
 
-u64 merge_block_with_no_cond_br::iter_do_merge(sir_context* ctx) {
-    u64 count = 0;
-    for (auto func : ctx->func_impls) {
-        count += do_single_merge(func);
-    }
-    return count;
-}
-
-bool merge_block_with_no_cond_br::run(sir_context* ctx) {
+u64 merge_block_with_no_cond_br::run_on_func(sir_func* func) {
+    u64 remove_count = 0;
     auto cfa = control_flow_analysis();
-    cfa.run(ctx);
+    cfa.analyze_func(func);
     while (true) {
-        auto count = iter_do_merge(ctx);
+        auto count = do_single_merge(func);
         if (!count) {
             break;
         }
-        cfa.run(ctx);
+        cfa.analyze_func(func);
         remove_count += count;
     }
-    return true;
+    return remove_count;
 }
 
 }
\ No newline at end of file
@@ -316,10 +316,10 @@ std::vector<std::string> sir_switch::get_case_labels() const {
 }
 
 void sir_switch::dump(std::ostream& out) const {
-    out << "switch i64 " << source << ", ";
+    out << "switch " << type << " " << source << ", ";
     out << "label %" << get_default_label() << " [\n";
     for (const auto& c : label_cases) {
-        out << "    i64 " << c.first << ", ";
+        out << "    " << type << " " << c.first << ", ";
         out << "label %label.L" << std::hex << c.second << std::dec << "\n";
     }
     out << "  ]\n";
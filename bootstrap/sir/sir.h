@@ -205,6 +205,8 @@ public:
         sir(sir_kind::sir_str), index(i), length(sl), target(tgt) {}
     ~sir_string() override = default;
     void dump(std::ostream&) const override;
+    auto get_index() const { return index; }
+    void set_index(usize i) { index = i; }
 };
 
 class sir_zeroinitializer: public sir {
@@ -290,6 +292,11 @@ public:
         with_va_args_real_param_size = s;
     }
     void set_debug_info_index(u64 i) { debug_info_index = i; }
+    void rebase_debug_info_index(u64 base) {
+        if (debug_info_index != DI_node::DI_ERROR_INDEX) {
+            debug_info_index += base;
+        }
+    }
     void dump(std::ostream&) const override;
 };
 
@@ -600,6 +607,11 @@ public:
         debug_info_index(dii) {}
     ~sir_store() override = default;
     void dump(std::ostream&) const override;
+    void rebase_debug_info_index(u64 base) {
+        if (debug_info_index != DI_node::DI_ERROR_INDEX) {
+            debug_info_index += base;
+        }
+    }
 };
 
 class sir_load: public sir {
@@ -662,12 +674,13 @@ public:
 class sir_switch: public sir {
 private:
     value_t source;
+    std::string type;
     usize label_default;
     std::vector<std::pair<i64, usize>> label_cases;
 
 public:
     sir_switch(const value_t& src):
-        sir(sir_kind::sir_switch), source(src) {}
+        sir(sir_kind::sir_switch), source(src), type("i64") {}
     ~sir_switch() override = default;
     void dump(std::ostream&) const override;
 
@@ -678,6 +691,7 @@ public:
     void set_default_label(usize dst_default) {
         label_default = dst_default;
     }
+    void set_type(const std::string& t) { type = t; }
     auto get_default_label_num() const { return label_default; }
     std::string get_default_label() const;
     const auto& get_cases() const { return label_cases; }
@@ -14,6 +14,7 @@ def execute(cmd: list[str], do_print: bool = True) -> int:
 
 TEST_LIST = [
     # file name                            | argv
+    ("test/alias_attribute.colgm",         []),
     ("test/align.colgm",                   []),
     ("test/array_type.colgm",              []),
     ("test/array.colgm",                   []),
@@ -25,33 +26,55 @@ TEST_LIST = [
     ("test/complex_generics.colgm",        []),
     ("test/const_fold.colgm",              []),
     ("test/continue_break.colgm",          []),
+    ("test/defer_cleanup.colgm",           []),
     ("test/defer_destruct_order.colgm",    []),
     ("test/defer.colgm",                   []),
     ("test/enum_test.colgm",               []),
     ("test/errno.colgm",                   []),
+    ("test/fold_identical.colgm",          []),
     ("test/for_iter.colgm",                []),
     ("test/for_test.colgm",                []),
     ("test/func.colgm",                    []),
     ("test/generic_embed.colgm",           []),
+    ("test/gvn.colgm",                     []),
     ("test/hello.colgm",                   []),
     ("test/initializer.colgm",             []),
+    ("test/inline.colgm",                  []),
+    ("test/io_buffer.colgm",               []),
     ("test/json_test.colgm",               []),
+    ("test/lazy_generic.colgm",            []),
     ("test/list_dir.colgm",                ["src"]),
+    ("test/load_store_elim.colgm",         []),
     ("test/local.colgm",                   []),
     ("test/match.colgm",                   []),
     ("test/md5_test.colgm",                []),
+    ("test/mem2reg.colgm",                 []),
     ("test/negative.colgm",                []),
+    ("test/net_test.colgm",                []),
     ("test/ref_struct_field.colgm",        []),
     ("test/ref_variable_assign.colgm",     []),
     ("test/regex_test.colgm",              []),
+    ("test/return_by_memory.colgm",        []),
+    ("test/sha256_test.colgm",             []),
+    ("test/socket_io_test.colgm",          []),
+    ("test/stack_alloc.colgm",             []),
     ("test/std_test.colgm",                []),
     ("test/string.colgm",                  []),
+    ("test/struct_layout.colgm",           []),
     ("test/union.colgm",                   []),
+    ("test/union_tag.colgm",               []),
     ("test/to_str.colgm",                  []),
     ("test/type_convert.colgm",            []),
     ("test/utf8_test.colgm",               []),
     ("test/void_return.colgm",             []),
-    ("test/warn_on_left_call.colgm",       [])
+    ("test/warn_on_left_call.colgm",       []),
+    ("test/xxhash_test.colgm",             [])
+]
+
+# these tests rely on unused generic instance methods being skipped,
+# others are compiled with --eager-generic to check all used std types
+LAZY_GENERIC_TEST = [
+    "test/lazy_generic.colgm"
 ]
 
 COMPILER = "build/colgm_self_host"
@@ -67,7 +90,7 @@ for (test, argv) in TEST_LIST:
         "-o", "test.out",
         "-O2",
         "-g"
-    ])
+    ] + ([] if test in LAZY_GENERIC_TEST else ["--eager-generic"]))
     if ret != 0:
         failed_list.append(test)
         continue
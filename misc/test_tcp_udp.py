@@ -19,6 +19,9 @@ def check_required():
     if not os.path.exists("example/socket/tcp_example.colgm"):
         print("Error: example/socket/tcp_example.colgm not found", flush=True)
         exit(1)
+    if not os.path.exists("example/socket/event_loop_example.colgm"):
+        print("Error: example/socket/event_loop_example.colgm not found", flush=True)
+        exit(1)
 
 def compile_tcp():
     subprocess.run([
@@ -38,6 +41,15 @@ def compile_udp():
         "-o", "tcp_udp_test.out"
     ])
 
+def compile_event_loop():
+    subprocess.run([
+        COMPILER,
+        "--library", "src",
+        "example/socket/event_loop_example.colgm",
+        "-g",
+        "-o", "tcp_udp_test.out"
+    ])
+
 def clear():
     if os.path.exists("tcp_udp_test.out"):
         os.remove("tcp_udp_test.out")
@@ -94,8 +106,25 @@ def test_udp():
         print("Error: test_udp failed", flush=True)
         exit(1)
 
+def test_event_loop():
+    compile_event_loop()
+    server = Thread(target=run_server)
+    client = Thread(target=run_client)
+
+    server.start()
+    time.sleep(1)
+    client.start()
+
+    server.join()
+    client.join()
+
+    if ERROR_RETURN:
+        print("Error: test_event_loop failed", flush=True)
+        exit(1)
+
 if __name__ == "__main__":
     check_required()
     test_tcp()
     test_udp()
+    test_event_loop()
     clear()